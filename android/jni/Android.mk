@@ -47,6 +47,11 @@ LOCAL_MODULE    := mandel-split
 LOCAL_SRC_FILES := \
 Julia.C \
 GmpFixedPoint.C \
+GmpMandelFixed.C \
+Perturbation.C \
+ResumeStore.C \
+TileCache.C \
+Telemetry.C \
 main.C \
 Job.C \
 MandelDrawer.C \
@@ -66,6 +71,10 @@ LOCAL_STATIC_LIBRARIES := freetype2 gmp
 LOCAL_LDLIBS    := -llog -landroid -lGLESv2 -lEGL
 LOCAL_CPP_EXTENSION := .C
 LOCAL_CFLAGS := -DANDROID_LOGGER_TAG=mandel-split -ffast-math -g -O3 -funroll-loops --std=c++11
+# the NEON Julia kernels, without fused multiply-add,
+# so that they give the scalar counts
+LOCAL_ARM_NEON := true
+LOCAL_CFLAGS += -ffp-contract=off
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/src $(LOCAL_PATH)/boost_1_54_0 $(LOCAL_PATH)/freetype2/include $(LOCAL_PATH)
 
 include $(BUILD_SHARED_LIBRARY)